@@ -0,0 +1,197 @@
+#include "DeribitFullTrader.hpp"
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+std::string loadPayload(const std::string& name) {
+    std::ifstream file(std::string(DERIBIT_BENCH_DATA_DIR) + "/" + name);
+    if (!file) {
+        throw std::runtime_error("Missing sample payload: " + name);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+// Discards console output so the CLI printing cost is measured without flooding the report.
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+class ScopedSilence {
+public:
+    ScopedSilence() :
+        cout_buf_(std::cout.rdbuf(&null_buffer_)),
+        cerr_buf_(std::cerr.rdbuf(&null_buffer_)) {
+    }
+
+    ~ScopedSilence() {
+        std::cout.rdbuf(cout_buf_);
+        std::cerr.rdbuf(cerr_buf_);
+    }
+
+private:
+    NullBuffer null_buffer_;
+    std::streambuf* cout_buf_;
+    std::streambuf* cerr_buf_;
+};
+
+// Trader with the network send replaced by a byte counter.
+class OfflineTrader : public DeribitFullTrader {
+public:
+    OfflineTrader() : bytes_sent_(0) {
+    }
+
+    // Authenticates from the recorded reply. A missing fixture skips the benchmark instead of
+    // throwing, which would abort the whole run (and pgo-train with it).
+    bool startSession(benchmark::State& state) {
+        try {
+            ScopedSilence silence;
+            handleMessage(loadPayload("auth_response.json"));
+            return true;
+        }
+        catch (const std::exception& e) {
+            state.SkipWithError(e.what());
+            return false;
+        }
+    }
+
+    using DeribitFullTrader::handleMessage;
+    using DeribitFullTrader::handleSubscriptionUpdate;
+    using DeribitFullTrader::sendPrivateRequest;
+    using DeribitFullTrader::processCommand;
+    using DeribitFullTrader::splitCommand;
+
+    size_t bytesSent() const { return bytes_sent_; }
+
+protected:
+    void transmit(const std::string& payload) override {
+        bytes_sent_ += payload.size();
+    }
+
+private:
+    size_t bytes_sent_;
+};
+
+} // namespace
+
+// Message Parsing
+static void BM_HandleMessage(benchmark::State& state, const char* file) {
+    ScopedSilence silence;
+    OfflineTrader trader;
+    if (!trader.startSession(state)) return;
+    std::string message;
+    try {
+        message = loadPayload(file);
+    }
+    catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    for (auto _ : state) {
+        trader.handleMessage(message);
+    }
+    state.SetBytesProcessed(state.iterations() * message.size());
+}
+BENCHMARK_CAPTURE(BM_HandleMessage, auth, "auth_response.json");
+BENCHMARK_CAPTURE(BM_HandleMessage, order_result, "buy_response.json");
+BENCHMARK_CAPTURE(BM_HandleMessage, error, "error_response.json");
+BENCHMARK_CAPTURE(BM_HandleMessage, book_update, "book_subscription.json");
+BENCHMARK_CAPTURE(BM_HandleMessage, ticker_update, "ticker_subscription.json");
+BENCHMARK_CAPTURE(BM_HandleMessage, trades_update, "trades_subscription.json");
+
+// Subscription Updates
+static void BM_HandleSubscriptionUpdate(benchmark::State& state, const char* file) {
+    ScopedSilence silence;
+    OfflineTrader trader;
+    if (!trader.startSession(state)) return;
+    json params;
+    try {
+        params = json::parse(loadPayload(file))["params"];
+    }
+    catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    for (auto _ : state) {
+        trader.handleSubscriptionUpdate(params);
+    }
+}
+BENCHMARK_CAPTURE(BM_HandleSubscriptionUpdate, book, "book_subscription.json");
+BENCHMARK_CAPTURE(BM_HandleSubscriptionUpdate, ticker, "ticker_subscription.json");
+BENCHMARK_CAPTURE(BM_HandleSubscriptionUpdate, trades, "trades_subscription.json");
+
+// Order Serialisation
+static void BM_SendPrivateRequest_LimitOrder(benchmark::State& state) {
+    OfflineTrader trader;
+    if (!trader.startSession(state)) return;
+    json params = {
+        {"instrument_name", "BTC-27DEC24-60000-C"},
+        {"amount", 1.0},
+        {"type", "limit"},
+        {"price", 0.0425},
+        {"time_in_force", "good_til_cancelled"},
+        {"post_only", false},
+        {"reduce_only", false}
+    };
+
+    for (auto _ : state) {
+        trader.sendPrivateRequest("private/buy", params);
+    }
+    state.SetBytesProcessed(trader.bytesSent());
+}
+BENCHMARK(BM_SendPrivateRequest_LimitOrder);
+
+static void BM_SendPrivateRequest_Cancel(benchmark::State& state) {
+    OfflineTrader trader;
+    if (!trader.startSession(state)) return;
+    json params = {
+        {"order_id", "29758251397"}
+    };
+
+    for (auto _ : state) {
+        trader.sendPrivateRequest("private/cancel", params);
+    }
+    state.SetBytesProcessed(trader.bytesSent());
+}
+BENCHMARK(BM_SendPrivateRequest_Cancel);
+
+// CLI Dispatch
+static void BM_SplitCommand(benchmark::State& state) {
+    OfflineTrader trader;
+    if (!trader.startSession(state)) return;
+    std::string command = "buy BTC-27DEC24-60000-C 1 0.0425";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(trader.splitCommand(command));
+    }
+}
+BENCHMARK(BM_SplitCommand);
+
+static void BM_ProcessCommand(benchmark::State& state, const char* command) {
+    ScopedSilence silence;
+    OfflineTrader trader;
+    if (!trader.startSession(state)) return;
+    std::string line = command;
+
+    for (auto _ : state) {
+        trader.processCommand(line);
+    }
+}
+BENCHMARK_CAPTURE(BM_ProcessCommand, buy_limit, "buy BTC-27DEC24-60000-C 1 0.0425");
+BENCHMARK_CAPTURE(BM_ProcessCommand, sell_market, "sell BTC-PERPETUAL 10 market");
+BENCHMARK_CAPTURE(BM_ProcessCommand, modify, "modify 29758251397 2 0.043");
+BENCHMARK_CAPTURE(BM_ProcessCommand, book, "book BTC-27DEC24-60000-C");
+BENCHMARK_CAPTURE(BM_ProcessCommand, sub_ticker, "sub ticker BTC-27DEC24-60000-C");
+BENCHMARK_CAPTURE(BM_ProcessCommand, invalid, "unknown command");
+
+BENCHMARK_MAIN();
@@ -0,0 +1,289 @@
+#include "ConnectionTuning.hpp"
+
+#include <benchmark/benchmark.h>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#ifndef DERIBIT_BENCH_DATA_DIR
+#define DERIBIT_BENCH_DATA_DIR "bench/data"
+#endif
+
+using boost::asio::ip::tcp;
+using ServerStream = boost::beast::websocket::stream<boost::beast::ssl_stream<tcp::socket>>;
+
+namespace {
+
+std::string loadPayload(const std::string& name) {
+    std::ifstream file(std::string(DERIBIT_BENCH_DATA_DIR) + "/" + name);
+    if (!file) {
+        throw std::runtime_error("Missing sample payload: " + name);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+// Same shape as the private/buy request produced by sendPrivateRequest.
+const char* kOrderRequest =
+    "{\"id\":12,\"jsonrpc\":\"2.0\",\"method\":\"private/buy\",\"params\":{"
+    "\"access_token\":\"1729245893614.1Lk4Fj1c.xN2p8cVb5Q7r3aH9wEy6tD1mK4zG0sJ8uL2oP5iR7nT\","
+    "\"amount\":1.0,\"instrument_name\":\"BTC-27DEC24-60000-C\",\"post_only\":false,"
+    "\"price\":0.0425,\"reduce_only\":false,\"time_in_force\":\"good_til_cancelled\","
+    "\"type\":\"limit\"}}";
+
+// Loads a throwaway P-256 key and self-signed certificate into the server context.
+void useSelfSignedCertificate(boost::asio::ssl::context& ctx) {
+    EVP_PKEY* key = nullptr;
+    EVP_PKEY_CTX* key_ctx = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+    if (!key_ctx ||
+        EVP_PKEY_keygen_init(key_ctx) <= 0 ||
+        EVP_PKEY_CTX_set_ec_paramgen_curve_nid(key_ctx, NID_X9_62_prime256v1) <= 0 ||
+        EVP_PKEY_keygen(key_ctx, &key) <= 0) {
+        EVP_PKEY_CTX_free(key_ctx);
+        throw std::runtime_error("Failed to generate server key");
+    }
+    EVP_PKEY_CTX_free(key_ctx);
+
+    X509* cert = X509_new();
+    X509_set_version(cert, 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+    X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+    X509_gmtime_adj(X509_getm_notAfter(cert), 24 * 3600);
+    X509_set_pubkey(cert, key);
+    X509_NAME* name = X509_get_subject_name(cert);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+        reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+    X509_set_issuer_name(cert, name);
+    bool ok = X509_sign(cert, key, EVP_sha256()) > 0 &&
+        SSL_CTX_use_certificate(ctx.native_handle(), cert) == 1 &&
+        SSL_CTX_use_PrivateKey(ctx.native_handle(), key) == 1;
+    X509_free(cert);
+    EVP_PKEY_free(key);
+    if (!ok) {
+        throw std::runtime_error("Failed to load server certificate");
+    }
+}
+
+// WebSocket-over-TLS echo server on 127.0.0.1 serving one connection at a time from its own
+// thread. It accepts permessage-deflate whenever the client offers it.
+class LoopbackWebSocketServer {
+public:
+    LoopbackWebSocketServer() :
+        ctx_(boost::asio::ssl::context::tls_server),
+        acceptor_(io_, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+        stopping_(false) {
+        SSL_CTX_set_min_proto_version(ctx_.native_handle(), TLS1_2_VERSION);
+        useSelfSignedCertificate(ctx_);
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    ~LoopbackWebSocketServer() {
+        stopping_ = true;
+        // Unblock the pending accept.
+        boost::system::error_code ec;
+        tcp::socket wake(io_);
+        wake.connect(acceptor_.local_endpoint(), ec);
+        thread_.join();
+    }
+
+    tcp::resolver::results_type endpoints() const {
+        tcp::endpoint endpoint = acceptor_.local_endpoint();
+        return tcp::resolver::results_type::create(endpoint, "localhost",
+            std::to_string(endpoint.port()));
+    }
+
+private:
+    boost::asio::io_context io_;
+    boost::asio::ssl::context ctx_;
+    tcp::acceptor acceptor_;
+    std::atomic<bool> stopping_;
+    std::thread thread_;
+
+    void run() {
+        while (!stopping_) {
+            boost::system::error_code ec;
+            tcp::socket socket(io_);
+            acceptor_.accept(socket, ec);
+            if (ec || stopping_) continue;
+            socket.set_option(tcp::no_delay(true), ec);
+
+            ServerStream ws(std::move(socket), ctx_);
+            ws.next_layer().handshake(boost::asio::ssl::stream_base::server, ec);
+            if (ec) continue;
+            boost::beast::websocket::permessage_deflate deflate;
+            deflate.server_enable = true;
+            ws.set_option(deflate);
+            ws.accept(ec);
+            if (ec) continue;
+
+            // Ends when the client closes; Beast answers the close and the TLS close_notify,
+            // which keeps the client's session resumable.
+            boost::beast::flat_buffer buffer;
+            for (;;) {
+                ws.read(buffer, ec);
+                if (ec) break;
+                ws.text(ws.got_text());
+                ws.write(buffer.data(), ec);
+                if (ec) break;
+                buffer.consume(buffer.size());
+            }
+        }
+    }
+};
+
+struct WireBytes {
+    unsigned long in;
+    unsigned long out;
+};
+
+WireBytes wireBytes(WebSocketStream& ws) {
+    SSL* ssl = ws.next_layer().native_handle();
+    return { BIO_number_read(SSL_get_rbio(ssl)), BIO_number_written(SSL_get_wbio(ssl)) };
+}
+
+// Opens a connection the same way the trader does and fails when a requested deflate is refused.
+void openClient(WebSocketStream& ws, const LoopbackWebSocketServer& server,
+    const ConnectionOptions& options, TlsSessionCache& sessions) {
+    std::string extensions = openWebSocket(ws, server.endpoints(), "localhost", "/ws/api/v2",
+        options, sessions);
+    if (options.enable_compression && extensions.find("permessage-deflate") == std::string::npos) {
+        throw std::runtime_error("permessage-deflate was not negotiated");
+    }
+    ws.text(true);
+}
+
+void echo(WebSocketStream& ws, const std::string& payload, boost::beast::flat_buffer& reply) {
+    ws.write(boost::asio::buffer(payload));
+    reply.consume(reply.size());
+    ws.read(reply);
+    if (reply.size() != payload.size()) {
+        throw std::runtime_error("Echo does not match the request");
+    }
+}
+
+void closeClient(WebSocketStream& ws) {
+    boost::system::error_code ec;
+    ws.close(boost::beast::websocket::close_code::normal, ec);
+}
+
+} // namespace
+
+// Reconnect: TCP connect, TLS and WebSocket handshakes, one order round trip and a clean close.
+// Args: tls13, resume, nodelay, deflate.
+static void BM_WebSocketReconnect(benchmark::State& state) {
+    boost::asio::io_context io;
+    ConnectionOptions options;
+    options.enable_tls13 = state.range(0) != 0;
+    options.reuse_tls_session = state.range(1) != 0;
+    options.tcp_no_delay = state.range(2) != 0;
+    options.enable_compression = state.range(3) != 0;
+
+    boost::asio::ssl::context ctx(boost::asio::ssl::context::tls_client);
+    TlsSessionCache sessions;
+    configureTlsContext(ctx, options, sessions);
+
+    std::string payload = kOrderRequest;
+    boost::beast::flat_buffer reply;
+    double resumed = 0;
+    double wire_in = 0;
+    double wire_out = 0;
+
+    try {
+        LoopbackWebSocketServer server;
+
+        // Prime the session cache so that resumed runs measure only resumed handshakes.
+        {
+            WebSocketStream ws(io, ctx);
+            openClient(ws, server, options, sessions);
+            echo(ws, payload, reply);
+            closeClient(ws);
+        }
+
+        for (auto _ : state) {
+            WebSocketStream ws(io, ctx);
+            openClient(ws, server, options, sessions);
+            echo(ws, payload, reply);
+            closeClient(ws);
+
+            resumed += SSL_session_reused(ws.next_layer().native_handle()) == 1 ? 1 : 0;
+            WireBytes wire = wireBytes(ws);
+            wire_in += wire.in;
+            wire_out += wire.out;
+        }
+    }
+    catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    state.counters["resumed"] = benchmark::Counter(resumed, benchmark::Counter::kAvgIterations);
+    state.counters["wire_in"] = benchmark::Counter(wire_in, benchmark::Counter::kAvgIterations);
+    state.counters["wire_out"] = benchmark::Counter(wire_out, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_WebSocketReconnect)
+    ->ArgNames({"tls13", "resume", "nodelay", "deflate"})
+    ->ArgsProduct({{0, 1}, {0, 1}, {0, 1}, {0, 1}})
+    ->UseRealTime();
+
+// Steady state: one message and its echo over an established TLS 1.3 connection.
+// cold_wire_out is the first message on the connection; wire_in/wire_out average the rest.
+// Args: nodelay, deflate.
+static void BM_WebSocketRoundTrip(benchmark::State& state, const char* file) {
+    boost::asio::io_context io;
+    ConnectionOptions options;
+    options.reuse_tls_session = false;
+    options.tcp_no_delay = state.range(0) != 0;
+    options.enable_compression = state.range(1) != 0;
+
+    boost::asio::ssl::context ctx(boost::asio::ssl::context::tls_client);
+    TlsSessionCache sessions;
+    configureTlsContext(ctx, options, sessions);
+
+    std::string payload;
+    boost::beast::flat_buffer reply;
+
+    try {
+        payload = file ? loadPayload(file) : std::string(kOrderRequest);
+        LoopbackWebSocketServer server;
+        WebSocketStream ws(io, ctx);
+        openClient(ws, server, options, sessions);
+
+        WireBytes before = wireBytes(ws);
+        echo(ws, payload, reply);
+        WireBytes start = wireBytes(ws);
+
+        for (auto _ : state) {
+            echo(ws, payload, reply);
+        }
+
+        WireBytes end = wireBytes(ws);
+        state.counters["cold_wire_out"] = static_cast<double>(start.out - before.out);
+        state.counters["wire_in"] = benchmark::Counter(static_cast<double>(end.in - start.in),
+            benchmark::Counter::kAvgIterations);
+        state.counters["wire_out"] = benchmark::Counter(static_cast<double>(end.out - start.out),
+            benchmark::Counter::kAvgIterations);
+        closeClient(ws);
+    }
+    catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.counters["payload"] = static_cast<double>(payload.size());
+    state.SetBytesProcessed(state.iterations() * payload.size() * 2);
+}
+BENCHMARK_CAPTURE(BM_WebSocketRoundTrip, order, nullptr)
+    ->ArgNames({"nodelay", "deflate"})
+    ->ArgsProduct({{0, 1}, {0, 1}})
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_WebSocketRoundTrip, book_update, "book_subscription.json")
+    ->ArgNames({"nodelay", "deflate"})
+    ->ArgsProduct({{0, 1}, {0, 1}})
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+#include "ConnectionTuning.hpp"
+
+#include <iostream>
+
+namespace {
+
+// asio owns the SSL_CTX app data slot for its verify callback, so the cache needs its own index.
+int sessionCacheIndex() {
+    static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    return index;
+}
+
+} // namespace
+
+TlsSessionCache::TlsSessionCache() :
+    session_(nullptr) {
+}
+
+TlsSessionCache::~TlsSessionCache() {
+    clear();
+}
+
+void TlsSessionCache::attach(SSL_CTX* ctx) {
+    // Sessions are kept here; OpenSSL's internal cache is only consulted on the server side.
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_set_ex_data(ctx, sessionCacheIndex(), this);
+    SSL_CTX_sess_set_new_cb(ctx, &TlsSessionCache::onNewSession);
+}
+
+void TlsSessionCache::apply(SSL* ssl) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (session_) {
+        SSL_set_session(ssl, session_);
+    }
+}
+
+void TlsSessionCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (session_) {
+        SSL_SESSION_free(session_);
+        session_ = nullptr;
+    }
+}
+
+// Returning 1 takes ownership of the session reference.
+int TlsSessionCache::onNewSession(SSL* ssl, SSL_SESSION* session) {
+    auto* self = static_cast<TlsSessionCache*>(
+        SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), sessionCacheIndex()));
+    std::lock_guard<std::mutex> lock(self->mutex_);
+    if (self->session_) {
+        SSL_SESSION_free(self->session_);
+    }
+    self->session_ = session;
+    return 1;
+}
+
+void configureTlsContext(boost::asio::ssl::context& ctx, const ConnectionOptions& options,
+    TlsSessionCache& sessions) {
+    SSL_CTX* native = ctx.native_handle();
+    SSL_CTX_set_min_proto_version(native, TLS1_2_VERSION);
+    SSL_CTX_set_max_proto_version(native, options.enable_tls13 ? TLS1_3_VERSION : TLS1_2_VERSION);
+
+    if (options.reuse_tls_session) {
+        sessions.attach(native);
+    }
+}
+
+void applySocketOptions(boost::asio::ip::tcp::socket& socket, const ConnectionOptions& options) {
+    boost::system::error_code ec;
+    socket.set_option(boost::asio::ip::tcp::no_delay(options.tcp_no_delay), ec);
+    if (ec) {
+        std::cerr << "Failed to set TCP_NODELAY: " << ec.message() << std::endl;
+    }
+    if (options.receive_buffer_size > 0) {
+        socket.set_option(boost::asio::socket_base::receive_buffer_size(
+            options.receive_buffer_size), ec);
+        if (ec) {
+            std::cerr << "Failed to set SO_RCVBUF: " << ec.message() << std::endl;
+        }
+    }
+    if (options.send_buffer_size > 0) {
+        socket.set_option(boost::asio::socket_base::send_buffer_size(
+            options.send_buffer_size), ec);
+        if (ec) {
+            std::cerr << "Failed to set SO_SNDBUF: " << ec.message() << std::endl;
+        }
+    }
+}
+
+std::string openWebSocket(WebSocketStream& ws,
+    const boost::asio::ip::tcp::resolver::results_type& endpoints,
+    const std::string& host, const std::string& target,
+    const ConnectionOptions& options, TlsSessionCache& sessions) {
+    auto& tcp_layer = boost::beast::get_lowest_layer(ws);
+    tcp_layer.connect(endpoints);
+    applySocketOptions(tcp_layer.socket(), options);
+
+    SSL* ssl = ws.next_layer().native_handle();
+    SSL_set_tlsext_host_name(ssl, host.c_str());
+    if (options.reuse_tls_session) {
+        sessions.apply(ssl);
+    }
+    ws.next_layer().handshake(boost::asio::ssl::stream_base::client);
+
+    // The extension is only offered; frames stay uncompressed unless the server accepts it.
+    boost::beast::websocket::permessage_deflate deflate;
+    deflate.client_enable = options.enable_compression;
+    ws.set_option(deflate);
+    ws.set_option(boost::beast::websocket::stream_base::timeout::suggested(
+        boost::beast::role_type::client));
+
+    boost::beast::websocket::response_type response;
+    ws.handshake(response, host, target);
+    return std::string(response[boost::beast::http::field::sec_websocket_extensions]);
+}
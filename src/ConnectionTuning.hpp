@@ -0,0 +1,56 @@
+#pragma once
+
+#include <boost/beast/core.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+#include <openssl/ssl.h>
+#include <mutex>
+#include <string>
+
+using WebSocketStream = boost::beast::websocket::stream<
+    boost::beast::ssl_stream<boost::beast::tcp_stream>>;
+
+// Transport settings applied on every (re)connect. Buffer sizes of 0 keep the OS defaults.
+struct ConnectionOptions {
+    bool enable_compression = false;
+    bool enable_tls13 = true;
+    bool reuse_tls_session = true;
+    bool tcp_no_delay = true;
+    int receive_buffer_size = 0;
+    int send_buffer_size = 0;
+};
+
+// Holds the latest client session so that the next handshake can resume it.
+class TlsSessionCache {
+public:
+    TlsSessionCache();
+    ~TlsSessionCache();
+    TlsSessionCache(const TlsSessionCache&) = delete;
+    TlsSessionCache& operator=(const TlsSessionCache&) = delete;
+
+    // Routes new sessions and TLS 1.3 tickets issued on this context into the cache.
+    void attach(SSL_CTX* ctx);
+    void apply(SSL* ssl);
+    void clear();
+
+private:
+    std::mutex mutex_;
+    SSL_SESSION* session_;
+
+    static int onNewSession(SSL* ssl, SSL_SESSION* session);
+};
+
+// Restricts the protocol range and hooks up session reuse according to the options.
+void configureTlsContext(boost::asio::ssl::context& ctx, const ConnectionOptions& options,
+    TlsSessionCache& sessions);
+
+// Must be called on a connected socket; failures are reported and otherwise ignored.
+void applySocketOptions(boost::asio::ip::tcp::socket& socket, const ConnectionOptions& options);
+
+// Runs the TCP connect, TLS and WebSocket handshakes on a fresh stream and returns the
+// negotiated Sec-WebSocket-Extensions header. Throws boost::system::system_error on failure.
+std::string openWebSocket(WebSocketStream& ws,
+    const boost::asio::ip::tcp::resolver::results_type& endpoints,
+    const std::string& host, const std::string& target,
+    const ConnectionOptions& options, TlsSessionCache& sessions);
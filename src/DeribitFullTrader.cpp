@@ -0,0 +1,772 @@
+#include "DeribitFullTrader.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+DeribitFullTrader::DeribitFullTrader(const ConnectionOptions& options) :
+    options_(options),
+    tls_context_(boost::asio::ssl::context::tls_client),
+    close_requested_(false),
+    request_id_(1),
+    is_authenticated_(false),
+    is_connected_(false),
+    use_testnet_(true),
+    show_subscription_updates_(true),
+    payload_bytes_in_(0),
+    payload_bytes_out_(0),
+    last_connect_ms_(0) {
+    // One context for the lifetime of the trader so that session tickets survive reconnects.
+    configureTlsContext(tls_context_, options_, tls_sessions_);
+}
+
+DeribitFullTrader::~DeribitFullTrader() {
+    disconnect();
+}
+
+void DeribitFullTrader::connect(bool use_testnet) {
+    use_testnet_ = use_testnet;
+    const std::string host = use_testnet ? "test.deribit.com" : "www.deribit.com";
+    const std::string target = "/ws/api/v2";
+
+    // The io loop of a dropped connection has already returned but may not have been joined yet.
+    if (client_thread_.joinable()) {
+        client_thread_.join();
+    }
+    // A fresh io_context discards any handlers still queued for the previous connection.
+    ws_.reset();
+    io_ = std::make_unique<boost::asio::io_context>();
+    ws_ = std::make_unique<WebSocketStream>(*io_, tls_context_);
+    read_buffer_.consume(read_buffer_.size());
+    write_queue_.clear();
+    close_requested_ = false;
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        boost::asio::ip::tcp::resolver resolver(*io_);
+        negotiated_extensions_ = openWebSocket(*ws_, resolver.resolve(host, "443"),
+            host, target, options_, tls_sessions_);
+    }
+    catch (const boost::system::system_error& e) {
+        throw std::runtime_error("Connection error: " + e.code().message());
+    }
+
+    last_connect_ms_ = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    payload_bytes_in_ = 0;
+    payload_bytes_out_ = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_connected_ = true;
+    }
+
+    startRead();
+    client_thread_ = std::thread([this]() {
+        try {
+            io_->run();
+        }
+        catch (const std::exception& e) {
+            std::cerr << "WebSocket error: " << e.what() << std::endl;
+        }
+        });
+
+    bool resumed = SSL_session_reused(ws_->next_layer().native_handle()) == 1;
+    std::cout << "Connected in " << std::fixed << std::setprecision(1) << last_connect_ms_
+        << " ms" << (resumed ? " (TLS session resumed)" : "")
+        << (negotiated_extensions_.empty() ? "" : " (" + negotiated_extensions_ + ")")
+        << std::endl;
+}
+
+void DeribitFullTrader::reconnect() {
+    disconnect();
+
+    std::string refresh_token;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_authenticated_ = false;
+        refresh_token = refresh_token_;
+    }
+    connect(use_testnet_);
+
+    // Authentication and subscriptions belong to the WebSocket session and must be redone.
+    if (!refresh_token.empty()) {
+        json auth_params = {
+            {"grant_type", "refresh_token"},
+            {"refresh_token", refresh_token}
+        };
+        sendRequest("public/auth", auth_params);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cv_.wait_for(lock, std::chrono::seconds(10), [this] { return is_authenticated_; })) {
+            std::cerr << "Re-authentication timed out" << std::endl;
+        }
+    }
+    restoreSubscriptions();
+}
+
+void DeribitFullTrader::disconnect() {
+    if (ws_ && isConnected()) {
+        boost::asio::post(ws_->get_executor(), [this]() {
+            if (!ws_->is_open()) return;
+            // Only one write-type operation may be in flight, so a pending write closes afterwards.
+            if (write_queue_.empty()) {
+                startClose();
+            }
+            else {
+                close_requested_ = true;
+            }
+            });
+    }
+    if (client_thread_.joinable()) {
+        client_thread_.join();
+    }
+}
+
+void DeribitFullTrader::authenticate(const std::string& client_id, const std::string& client_secret) {
+    json auth_params = {
+        {"grant_type", "client_credentials"},
+        {"client_id", client_id},
+        {"client_secret", client_secret}
+    };
+
+    sendRequest("public/auth", auth_params);
+    waitForAuthentication();
+}
+
+void DeribitFullTrader::getTime() {
+    sendRequest("public/get_time", json::object());
+}
+
+void DeribitFullTrader::getInstruments(const std::string& currency, const std::string& kind) {
+    json params = {
+        {"currency", currency},
+        {"kind", kind}
+    };
+    sendRequest("public/get_instruments", params);
+}
+
+void DeribitFullTrader::getCurrencies() {
+    sendRequest("public/get_currencies", json::object());
+}
+
+void DeribitFullTrader::getOrderbook(const std::string& instrument_name, int depth) {
+    json params = {
+        {"instrument_name", instrument_name},
+        {"depth", depth}
+    };
+    sendRequest("public/get_order_book", params);
+}
+
+void DeribitFullTrader::getTradingviewChartData(const std::string& instrument_name,
+    const std::string& start_timestamp,
+    const std::string& end_timestamp,
+    const std::string& resolution) {
+    json params = {
+        {"instrument_name", instrument_name},
+        {"start_timestamp", start_timestamp},
+        {"end_timestamp", end_timestamp},
+        {"resolution", resolution}
+    };
+    sendRequest("public/get_tradingview_chart_data", params);
+}
+
+void DeribitFullTrader::getAccountSummary(const std::string& currency) {
+    checkAuthentication();
+    json params = {
+        {"currency", currency}
+    };
+    sendPrivateRequest("private/get_account_summary", params);
+}
+
+void DeribitFullTrader::getPositions(const std::string& currency) {
+    checkAuthentication();
+    json params = {
+        {"currency", currency}
+    };
+    sendPrivateRequest("private/get_positions", params);
+}
+
+void DeribitFullTrader::placeBuyOrder(const std::string& instrument_name,
+    double amount,
+    double price,
+    const std::string& type) {
+    checkAuthentication();
+    json params = {
+        {"instrument_name", instrument_name},
+        {"amount", amount}
+    };
+
+    if (type == "market") {
+        params["type"] = "market";
+    }
+    else {
+        params["type"] = "limit";
+        params["price"] = price;
+        params["time_in_force"] = "good_til_cancelled";
+        params["post_only"] = false;
+        params["reduce_only"] = false;
+    }
+
+    sendPrivateRequest("private/buy", params);
+}
+
+void DeribitFullTrader::placeSellOrder(const std::string& instrument_name,
+    double amount,
+    double price,
+    const std::string& type) {
+    checkAuthentication();
+    json params = {
+        {"instrument_name", instrument_name},
+        {"amount", amount}
+    };
+
+    if (type == "market") {
+        params["type"] = "market";
+    }
+    else {
+        params["type"] = "limit";
+        params["price"] = price;
+        params["time_in_force"] = "good_til_cancelled";
+        params["post_only"] = false;
+        params["reduce_only"] = false;
+    }
+
+    sendPrivateRequest("private/sell", params);
+}
+
+void DeribitFullTrader::cancelOrder(const std::string& order_id) {
+    checkAuthentication();
+    json params = {
+        {"order_id", order_id}
+    };
+    sendPrivateRequest("private/cancel", params);
+}
+
+void DeribitFullTrader::cancelAllOrders() {
+    checkAuthentication();
+    sendPrivateRequest("private/cancel_all", json::object());
+}
+
+void DeribitFullTrader::modifyOrder(const std::string& order_id,
+    double amount,
+    double price) {
+    checkAuthentication();
+    json params = {
+        {"order_id", order_id},
+        {"amount", amount},
+        {"price", price}
+    };
+    sendPrivateRequest("private/edit", params);
+}
+
+void DeribitFullTrader::getOpenOrders(const std::string& instrument_name) {
+    checkAuthentication();
+    json params;
+    if (!instrument_name.empty()) {
+        params["instrument_name"] = instrument_name;
+    }
+    sendPrivateRequest("private/get_open_orders_by_instrument", params);
+}
+
+void DeribitFullTrader::getOrderHistory(const std::string& instrument_name) {
+    checkAuthentication();
+    json params;
+    if (!instrument_name.empty()) {
+        params["instrument_name"] = instrument_name;
+    }
+    sendPrivateRequest("private/get_order_history_by_instrument", params);
+}
+
+void DeribitFullTrader::subscribeToOrderbook(const std::string& instrument_name) {
+    std::string channel = "book." + instrument_name + ".100ms";
+    json params = {
+        {"channels", {channel}}
+    };
+    sendRequest("public/subscribe", params);
+    addSubscription(channel);
+}
+
+void DeribitFullTrader::subscribeToTrades(const std::string& instrument_name) {
+    std::string channel = "trades." + instrument_name + ".100ms";
+    json params = {
+        {"channels", {channel}}
+    };
+    sendRequest("public/subscribe", params);
+    addSubscription(channel);
+}
+
+void DeribitFullTrader::subscribeToInstrument(const std::string& instrument_name) {
+    std::string channel = "ticker." + instrument_name + ".100ms";
+    json params = {
+        {"channels", {channel}}
+    };
+    sendRequest("public/subscribe", params);
+    addSubscription(channel);
+}
+
+void DeribitFullTrader::printConnectionStats() {
+    if (!ws_ || !isConnected()) {
+        std::cout << "Not connected" << std::endl;
+        return;
+    }
+
+    SSL* ssl = ws_->next_layer().native_handle();
+    const std::string& extensions = negotiated_extensions_;
+
+    std::cout << "\nConnection Stats:\n"
+        << "TLS Version: " << SSL_get_version(ssl) << "\n"
+        << "TLS Session Resumed: " << (SSL_session_reused(ssl) == 1 ? "yes" : "no") << "\n"
+        << "WebSocket Extensions: " << (extensions.empty() ? "none" : extensions) << "\n"
+        << "Payload Bytes In/Out: " << payload_bytes_in_ << " / " << payload_bytes_out_ << "\n"
+        << "Wire Bytes In/Out: " << BIO_number_read(SSL_get_rbio(ssl))
+        << " / " << BIO_number_written(SSL_get_wbio(ssl)) << "\n"
+        << "Last Connect Time: " << std::fixed << std::setprecision(1)
+        << last_connect_ms_ << " ms\n";
+}
+
+void DeribitFullTrader::startCLI() {
+    displayHelp();
+    std::string command;
+    while (true) {
+        std::cout << "\nDeribit> ";
+        std::getline(std::cin, command);
+        if (!command.empty()) {
+            processCommand(command);
+        }
+    }
+}
+
+bool DeribitFullTrader::isConnected() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return is_connected_;
+}
+
+// The read loop and the write queue only ever run on the io thread.
+void DeribitFullTrader::startRead() {
+    ws_->async_read(read_buffer_, [this](boost::beast::error_code ec, std::size_t) {
+        if (ec) {
+            onClosed(ec);
+            return;
+        }
+        std::string payload = boost::beast::buffers_to_string(read_buffer_.data());
+        read_buffer_.consume(read_buffer_.size());
+        payload_bytes_in_ += payload.size();
+        handleMessage(payload);
+        startRead();
+        });
+}
+
+void DeribitFullTrader::queueWrite(std::string payload) {
+    boost::asio::post(ws_->get_executor(), [this, payload = std::move(payload)]() mutable {
+        write_queue_.push_back(std::move(payload));
+        if (write_queue_.size() == 1) {
+            startWrite();
+        }
+        });
+}
+
+void DeribitFullTrader::startWrite() {
+    ws_->text(true);
+    ws_->async_write(boost::asio::buffer(write_queue_.front()),
+        [this](boost::beast::error_code ec, std::size_t) {
+            if (ec) {
+                std::cerr << "Write error: " << ec.message() << std::endl;
+                write_queue_.clear();
+                return;
+            }
+            write_queue_.pop_front();
+            if (!write_queue_.empty()) {
+                startWrite();
+            }
+            else if (close_requested_) {
+                startClose();
+            }
+        });
+}
+
+void DeribitFullTrader::startClose() {
+    ws_->async_close(boost::beast::websocket::close_code::normal, [](boost::beast::error_code ec) {
+        if (ec) {
+            std::cerr << "Close error: " << ec.message() << std::endl;
+        }
+        });
+}
+
+void DeribitFullTrader::onClosed(const boost::beast::error_code& ec) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_connected_ = false;
+    }
+    if (ec != boost::beast::websocket::error::closed &&
+        ec != boost::asio::error::operation_aborted) {
+        std::cerr << "WebSocket error: " << ec.message() << std::endl;
+    }
+}
+
+void DeribitFullTrader::waitForAuthentication() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return is_authenticated_; });
+}
+
+void DeribitFullTrader::checkAuthentication() {
+    if (!is_authenticated_) {
+        throw std::runtime_error("Not authenticated");
+    }
+}
+
+void DeribitFullTrader::sendRequest(const std::string& method, const json& params) {
+    json request = {
+        {"jsonrpc", "2.0"},
+        {"id", request_id_++},
+        {"method", method},
+        {"params", params}
+    };
+
+    try {
+        std::string payload = request.dump();
+        payload_bytes_out_ += payload.size();
+        transmit(payload);
+    }
+    catch (const std::exception& e) {
+        throw std::runtime_error("Failed to send request: " + std::string(e.what()));
+    }
+}
+
+void DeribitFullTrader::transmit(const std::string& payload) {
+    if (!ws_ || !isConnected()) {
+        throw std::runtime_error("Not connected");
+    }
+    queueWrite(payload);
+}
+
+void DeribitFullTrader::sendPrivateRequest(const std::string& method, const json& params) {
+    json request_params = params;
+    request_params["access_token"] = access_token_;
+    sendRequest(method, request_params);
+}
+
+void DeribitFullTrader::addSubscription(const std::string& channel) {
+    std::lock_guard<std::mutex> lock(subscription_mutex_);
+    active_subscriptions_[channel] = true;
+    std::cout << "Subscribed to channel: " << channel << std::endl;
+}
+
+void DeribitFullTrader::restoreSubscriptions() {
+    json channels = json::array();
+    {
+        std::lock_guard<std::mutex> lock(subscription_mutex_);
+        for (const auto& sub : active_subscriptions_) {
+            if (sub.second) {
+                channels.push_back(sub.first);
+            }
+        }
+    }
+    if (channels.empty()) return;
+
+    json params = {
+        {"channels", channels}
+    };
+    sendRequest("public/subscribe", params);
+    std::cout << "Restored " << channels.size() << " subscription(s)" << std::endl;
+}
+
+void DeribitFullTrader::removeSubscription(const std::string& channel) {
+    std::lock_guard<std::mutex> lock(subscription_mutex_);
+    active_subscriptions_[channel] = false;
+    std::cout << "Unsubscribed from channel: " << channel << std::endl;
+}
+
+void DeribitFullTrader::handleSubscriptionUpdate(const json& params) {
+    std::string channel = params["channel"];
+    std::cout << "Subscription update for channel " << channel << ":\n";
+    std::cout << params["data"].dump(2) << std::endl;
+}
+
+void DeribitFullTrader::handleMessage(const std::string& message) {
+    try {
+        json response = json::parse(message);
+
+        // Handle authentication response
+        if (response.contains("result") &&
+            response["result"].contains("access_token")) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            access_token_ = response["result"]["access_token"];
+            refresh_token_ = response["result"].value("refresh_token", "");
+            is_authenticated_ = true;
+            cv_.notify_all();
+            std::cout << "Authentication successful!" << std::endl;
+            return;
+        }
+
+        // Handle subscription messages
+        if (response.contains("method") && response["method"] == "subscription") {
+            handleSubscriptionUpdate(response["params"]);
+            return;
+        }
+
+        // Handle regular responses
+        if (response.contains("error")) {
+            std::cerr << "Error: " << response["error"]["message"] << std::endl;
+        }
+        else if (response.contains("result")) {
+            std::cout << "Result: " << response["result"].dump(2) << std::endl;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error parsing message: " << e.what() << std::endl;
+    }
+}
+
+void DeribitFullTrader::displayOrderbook(const json& data) {
+    if (!data.contains("bids") || !data.contains("asks")) return;
+
+    std::cout << "\nOrderbook for " << data["instrument_name"].get<std::string>() << "\n";
+    std::cout << std::string(50, '=') << "\n";
+    std::cout << std::left << std::setw(25) << "BIDS" << std::setw(25) << "ASKS" << "\n";
+    std::cout << std::string(50, '-') << "\n";
+
+    const auto& bids = data["bids"];
+    const auto& asks = data["asks"];
+    size_t max_size = std::max(bids.size(), asks.size());
+
+    for (size_t i = 0; i < max_size && i < 10; ++i) {
+        std::cout << std::fixed << std::setprecision(8);
+
+        // Print bids
+        if (i < bids.size()) {
+            std::cout << std::setw(12) << bids[i][0].get<double>()
+                << " | "
+                << std::setw(10) << bids[i][1].get<double>();
+        }
+        else {
+            std::cout << std::setw(25) << " ";
+        }
+
+        std::cout << " | ";
+
+        // Print asks
+        if (i < asks.size()) {
+            std::cout << std::setw(12) << asks[i][0].get<double>()
+                << " | "
+                << std::setw(10) << asks[i][1].get<double>();
+        }
+        std::cout << "\n";
+    }
+    std::cout << std::string(50, '=') << "\n";
+}
+
+void DeribitFullTrader::displayTrades(const json& data) {
+    std::cout << "\nTrade: "
+        << "Price: " << data["price"]
+        << " Amount: " << data["amount"]
+        << " Direction: " << data["direction"] << "\n";
+}
+
+void DeribitFullTrader::displayTicker(const json& data) {
+    std::cout << "\nTicker Update for " << data["instrument_name"] << ":\n"
+        << "Last Price: " << data["last_price"] << "\n"
+        << "Mark Price: " << data["mark_price"] << "\n"
+        << "Best Bid: " << data["best_bid_price"] << "\n"
+        << "Best Ask: " << data["best_ask_price"] << "\n";
+}
+
+void DeribitFullTrader::displayUserOrder(const json& data) {
+    std::cout << "\nOrder Update:\n"
+        << "Order ID: " << data["order_id"] << "\n"
+        << "Status: " << data["order_state"] << "\n"
+        << "Price: " << data["price"] << "\n"
+        << "Amount: " << data["amount"] << "\n";
+}
+
+void DeribitFullTrader::displayUserTrade(const json& data) {
+    std::cout << "\nTrade Update:\n"
+        << "Trade ID: " << data["trade_id"] << "\n"
+        << "Price: " << data["price"] << "\n"
+        << "Amount: " << data["amount"] << "\n"
+        << "Direction: " << data["direction"] << "\n";
+}
+
+void DeribitFullTrader::displayHelp() {
+    std::cout << "\n=== Deribit Trading Commands ===\n"
+        << "General:\n"
+        << "  help                                    - Show this help\n"
+        << "  quit                                    - Exit the program\n"
+        << "\nMarket Data:\n"
+        << "  book <instrument>                       - Get orderbook\n"
+        << "  instruments <currency> <kind>           - List available instruments\n"
+        << "  currencies                              - List available currencies\n"
+        << "  time                                    - Get server time\n"
+        << "\nTrading:\n"
+        << "  buy <instrument> <amount> <price>       - Place buy order\n"
+        << "  sell <instrument> <amount> <price>      - Place sell order\n"
+        << "  cancel <order_id>                       - Cancel specific order\n"
+        << "  cancelall                               - Cancel all orders\n"
+        << "  modify <order_id> <amount> <price>      - Modify order\n"
+        << "\nAccount:\n"
+        << "  positions <currency>                    - View positions\n"
+        << "  balance <currency>                      - Check account balance\n"
+        << "  orders <instrument>                     - View open orders\n"
+        << "  history <instrument>                    - View order history\n"
+        << "\nSubscriptions:\n"
+        << "  sub book <instrument>                   - Subscribe to orderbook\n"
+        << "  sub trades <instrument>                 - Subscribe to trades\n"
+        << "  sub ticker <instrument>                 - Subscribe to ticker\n"
+        << "  list subs                              - List active subscriptions\n"
+        << "\nConnection:\n"
+        << "  stats                                   - Show TLS/compression stats\n"
+        << "  reconnect                               - Reconnect and report timing\n"
+        << "=====================================\n";
+}
+
+void DeribitFullTrader::processCommand(const std::string& cmd) {
+    auto tokens = splitCommand(cmd);
+    if (tokens.empty()) return;
+
+    try {
+        const std::string& command = tokens[0];
+
+        // General commands
+        if (command == "help") {
+            displayHelp();
+        }
+        else if (command == "quit") {
+            std::cout << "Exiting...\n";
+            exit(0);
+        }
+        else if (command == "list" && tokens.size() == 2 && tokens[1] == "subs") {
+            listActiveSubscriptions();
+        }
+        // Connection commands
+        else if (command == "stats") {
+            printConnectionStats();
+        }
+        else if (command == "reconnect") {
+            reconnect();
+        }
+        // Market data commands
+        else if (command == "book" && tokens.size() == 2) {
+            getOrderbook(tokens[1]);
+        }
+        else if (command == "instruments" && tokens.size() == 3) {
+            getInstruments(tokens[1], tokens[2]);
+        }
+        else if (command == "currencies") {
+            getCurrencies();
+        }
+        else if (command == "time") {
+            getTime();
+        }
+        // Trading commands
+        else if (command == "buy" && tokens.size() >= 3) {
+            std::string instrument_name = tokens[1];
+            double amount = std::stod(tokens[2]);
+
+            if (tokens.size() >= 4 && tokens[3] == "market") {
+                placeBuyOrder(instrument_name, amount, 0, "market");
+                std::cout << "Placing market buy order: " << instrument_name
+                    << " Amount: " << amount << std::endl;
+            }
+            else if (tokens.size() >= 4) {
+                double price = std::stod(tokens[3]);
+                placeBuyOrder(instrument_name, amount, price, "limit");
+                std::cout << "Placing limit buy order: " << instrument_name
+                    << " Amount: " << amount << " Price: " << price << std::endl;
+            }
+            else {
+                std::cout << "Invalid buy command format. Use:\n"
+                    << "buy <instrument> <amount> market\n"
+                    << "buy <instrument> <amount> <price>" << std::endl;
+            }
+        }
+        else if (command == "sell" && tokens.size() >= 3) {
+            std::string instrument_name = tokens[1];
+            double amount = std::stod(tokens[2]);
+
+            if (tokens.size() >= 4 && tokens[3] == "market") {
+                placeSellOrder(instrument_name, amount, 0, "market");
+                std::cout << "Placing market sell order: " << instrument_name
+                    << " Amount: " << amount << std::endl;
+            }
+            else if (tokens.size() >= 4) {
+                double price = std::stod(tokens[3]);
+                placeSellOrder(instrument_name, amount, price, "limit");
+                std::cout << "Placing limit sell order: " << instrument_name
+                    << " Amount: " << amount << " Price: " << price << std::endl;
+            }
+            else {
+                std::cout << "Invalid sell command format. Use:\n"
+                    << "sell <instrument> <amount> market\n"
+                    << "sell <instrument> <amount> <price>" << std::endl;
+            }
+        }
+        else if (command == "cancel" && tokens.size() == 2) {
+            cancelOrder(tokens[1]);
+        }
+        else if (command == "cancelall") {
+            cancelAllOrders();
+        }
+        else if (command == "modify" && tokens.size() == 4) {
+            modifyOrder(tokens[1], std::stod(tokens[2]), std::stod(tokens[3]));
+        }
+        // Account commands
+        else if (command == "positions" && tokens.size() == 2) {
+            getPositions(tokens[1]);
+        }
+        else if (command == "balance" && tokens.size() == 2) {
+            getAccountSummary(tokens[1]);
+        }
+        else if (command == "orders") {
+            std::string instrument = tokens.size() > 1 ? tokens[1] : "";
+            getOpenOrders(instrument);
+        }
+        else if (command == "history") {
+            std::string instrument = tokens.size() > 1 ? tokens[1] : "";
+            getOrderHistory(instrument);
+        }
+        // Subscription commands
+        else if (command == "sub" && tokens.size() >= 3) {
+            const std::string& subType = tokens[1];
+            if (subType == "book") {
+                subscribeToOrderbook(tokens[2]);
+            }
+            else if (subType == "trades") {
+                subscribeToTrades(tokens[2]);
+            }
+            else if (subType == "ticker") {
+                subscribeToInstrument(tokens[2]);
+            }
+
+        }
+        else if (command == "list" && tokens.size() == 2 && tokens[1] == "subs") {
+            listActiveSubscriptions();
+        }
+
+        else {
+            std::cout << "Invalid command. Type 'help' for available commands.\n";
+        }
+    }
+    catch (const std::exception& e) {
+        std::cout << "Error processing command: " << e.what() << std::endl;
+    }
+}
+
+std::vector<std::string> DeribitFullTrader::splitCommand(const std::string& cmd) {
+    std::vector<std::string> tokens;
+    std::stringstream ss(cmd);
+    std::string token;
+    while (ss >> token) {
+        tokens.push_back(token);
+    }
+    return tokens;
+}
+
+void DeribitFullTrader::listActiveSubscriptions() {
+    std::lock_guard<std::mutex> lock(subscription_mutex_);
+    std::cout << "Active subscriptions:" << std::endl;
+    for (const auto& sub : active_subscriptions_) {
+        if (sub.second) {
+            std::cout << "- " << sub.first << std::endl;
+        }
+    }
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "ConnectionTuning.hpp"
+
+#include <nlohmann/json.hpp>
+#include <openssl/ssl.h>
+#include <string>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <map>
+#include <functional>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+using json = nlohmann::json;
+
+class DeribitFullTrader {
+public:
+    explicit DeribitFullTrader(const ConnectionOptions& options = ConnectionOptions());
+    virtual ~DeribitFullTrader();
+
+    // Connection Management
+    void connect(bool use_testnet = true);
+    void reconnect();
+    void disconnect();
+
+    // Authentication
+    void authenticate(const std::string& client_id, const std::string& client_secret);
+
+    // Public API Methods
+    void getTime();
+    void getInstruments(const std::string& currency, const std::string& kind);
+    void getCurrencies();
+    void getOrderbook(const std::string& instrument_name, int depth = 5);
+    void getTradingviewChartData(const std::string& instrument_name,
+        const std::string& start_timestamp,
+        const std::string& end_timestamp,
+        const std::string& resolution);
+
+    // Private API Methods - Account
+    void getAccountSummary(const std::string& currency);
+    void getPositions(const std::string& currency);
+
+    // Private API Methods - Trading
+    void placeBuyOrder(const std::string& instrument_name,
+        double amount,
+        double price = 0,
+        const std::string& type = "limit");
+    void placeSellOrder(const std::string& instrument_name,
+        double amount,
+        double price = 0,
+        const std::string& type = "limit");
+    void cancelOrder(const std::string& order_id);
+    void cancelAllOrders();
+    void modifyOrder(const std::string& order_id,
+        double amount,
+        double price);
+    void getOpenOrders(const std::string& instrument_name = "");
+    void getOrderHistory(const std::string& instrument_name = "");
+
+    //Subscription Methods
+    void subscribeToOrderbook(const std::string& instrument_name);
+    void subscribeToTrades(const std::string& instrument_name);
+    void subscribeToInstrument(const std::string& instrument_name);
+
+    // Connection Statistics
+    void printConnectionStats();
+
+    // CLI Interface
+    void startCLI();
+
+protected:
+    // Message path hooks, protected so the benchmarks can drive them without a live connection.
+    virtual void transmit(const std::string& payload);
+    void sendRequest(const std::string& method, const json& params);
+    void sendPrivateRequest(const std::string& method, const json& params);
+    void handleSubscriptionUpdate(const json& params);
+    void handleMessage(const std::string& message);
+    void processCommand(const std::string& cmd);
+    std::vector<std::string> splitCommand(const std::string& cmd);
+
+private:
+    ConnectionOptions options_;
+    TlsSessionCache tls_sessions_;
+    boost::asio::ssl::context tls_context_;
+    std::unique_ptr<boost::asio::io_context> io_;
+    std::unique_ptr<WebSocketStream> ws_;
+    boost::beast::flat_buffer read_buffer_;
+    std::deque<std::string> write_queue_;
+    bool close_requested_;
+    std::string negotiated_extensions_;
+    std::thread client_thread_;
+    int request_id_;
+    std::string access_token_;
+    std::string refresh_token_;
+    bool is_authenticated_;
+    bool is_connected_;
+    bool use_testnet_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<std::string, bool> active_subscriptions_;
+    std::mutex subscription_mutex_;
+    bool show_subscription_updates_;
+    std::map<std::string, std::function<void(const json&)>> subscription_handlers_;
+    std::mutex handlers_mutex_;
+    std::atomic<size_t> payload_bytes_in_;
+    std::atomic<size_t> payload_bytes_out_;
+    double last_connect_ms_;
+
+    bool isConnected();
+    void startRead();
+    void queueWrite(std::string payload);
+    void startWrite();
+    void startClose();
+    void onClosed(const boost::beast::error_code& ec);
+    void waitForAuthentication();
+    void checkAuthentication();
+    void addSubscription(const std::string& channel);
+    void restoreSubscriptions();
+    void removeSubscription(const std::string& channel);
+
+    // Display Methods
+    void displayOrderbook(const json& data);
+    void displayTrades(const json& data);
+    void displayTicker(const json& data);
+    void displayUserOrder(const json& data);
+    void displayUserTrade(const json& data);
+    void displayHelp();
+
+    void listActiveSubscriptions();
+};
@@ -0,0 +1,80 @@
+#include "DeribitFullTrader.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+// Empty input keeps the default.
+bool promptYesNo(const std::string& question, bool default_value) {
+    std::string answer;
+    std::cout << question << (default_value ? " (Y/n): " : " (y/N): ");
+    std::getline(std::cin, answer);
+    if (answer.empty()) return default_value;
+    return answer == "y" || answer == "Y";
+}
+
+int promptBufferSize(const std::string& question) {
+    std::string answer;
+    std::cout << question << " in bytes (empty for OS default): ";
+    std::getline(std::cin, answer);
+    if (answer.empty()) return 0;
+    try {
+        return std::max(0, std::stoi(answer));
+    }
+    catch (const std::exception&) {
+        std::cout << "Invalid size, using OS default.\n";
+        return 0;
+    }
+}
+
+ConnectionOptions promptConnectionOptions() {
+    ConnectionOptions options;
+    std::string customize;
+    std::cout << "Customize connection options? (y/n): ";
+    std::getline(std::cin, customize);
+    if (customize != "y" && customize != "Y") return options;
+
+    options.enable_compression = promptYesNo("Offer permessage-deflate compression?", options.enable_compression);
+    options.enable_tls13 = promptYesNo("Allow TLS 1.3?", options.enable_tls13);
+    options.reuse_tls_session = promptYesNo("Resume TLS sessions on reconnect?", options.reuse_tls_session);
+    options.tcp_no_delay = promptYesNo("Enable TCP_NODELAY?", options.tcp_no_delay);
+    options.receive_buffer_size = promptBufferSize("Socket receive buffer");
+    options.send_buffer_size = promptBufferSize("Socket send buffer");
+    return options;
+}
+
+int main() {
+    try {
+
+        // Get connection type from user
+        std::string network_type;
+        std::cout << "Connect to testnet? (y/n): ";
+        std::getline(std::cin, network_type);
+        bool use_testnet = (network_type == "y" || network_type == "Y");
+
+        DeribitFullTrader trader(promptConnectionOptions());
+
+        // Connect to appropriate network
+        std::cout << "Connecting to Deribit " << (use_testnet ? "testnet" : "mainnet") << "...\n";
+        trader.connect(use_testnet);
+
+        // Get API credentials
+        std::string client_id, client_secret;
+        std::cout << "Enter client_id: ";
+        std::getline(std::cin, client_id);
+        std::cout << "Enter client_secret: ";
+        std::getline(std::cin, client_secret);
+
+        // Authenticate
+        trader.authenticate(client_id, client_secret);
+
+        // Start CLI
+        std::cout << "\nStarting trading interface...\n";
+        trader.startCLI();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Fatal error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}